@@ -0,0 +1,81 @@
+REBOL [
+	purpose: {Time c.lexical over a corpus of C files against per-character versions of its hot rules.}
+]
+
+do %c-lexicals.complete.reb
+
+timeit: funct [block][recycle start: now/precise do block difference now/precise start]
+
+; The corpus directory is given on the command line, for example src/ of a
+; Ren-C checkout.
+if empty? any [system/options/args []] [
+	do make error! {Usage: bench-c-lexing.r <directory of C files>}
+]
+corpus: dirize to-rebol-file first system/options/args
+
+c-files: funct [dir] [
+	collect [
+		foreach file read dir [
+			either dir? file [
+				keep c-files dir/:file
+			][
+				if find [%.c %.h] suffix? file [keep dir/:file]
+			]
+		]
+	]
+]
+
+texts: map-each file c-files corpus [to string! read file]
+
+; Rules as they were before being rewritten for speed.
+
+per-char: make c.lexical/grammar bind [
+
+	identifier: [id.nondigit any id.char]
+
+	pp-number: [
+		[digit | #"." digit]
+		any [
+			digit
+			| id.nondigit
+			| #"."
+			| [#"e" | #"p" | #"E" | #"P"] sign
+		]
+	]
+
+	wsp: [some ws-char]
+
+	character-constant: [
+		#"'" some c-char #"'"
+		| {L'} some c-char #"'"
+		| {u'} some c-char #"'"
+		| {U'} some c-char #"'"
+	]
+
+	string-literal: [
+		opt encoding-prefix #"^"" any s-char #"^""
+	]
+
+	header-name: [#"<" some h-char #">" | #"^"" some q-char #"^""]
+
+	punctuator: [
+		{->} | {++} | {--} | {<<} | {>>} | {<=} | {>=} | {==} | {!=}
+		| {&&} | {||} | {...} | {*=} | {/=} | {%=} | {+=} | {<<=} | {>>=}
+		| {&=} | {^^=} | {|=} | {##} | {<:} | {:>} | {<%} | {%>}
+		| {%:%:} | {%:}
+		| p-char
+	]
+
+] c.lexical/charsets
+
+lex: funct [grammar] [
+	foreach text texts [parse/all/case text grammar/text]
+]
+
+results: reduce [
+	'per-char timeit [lex per-char]
+	'c.lexical timeit [lex c.lexical/grammar]
+]
+
+print [length? texts {files}]
+print mold new-line/all/skip results true 2
@@ -0,0 +1,40 @@
+REBOL [
+	purpose: {Compare token-matching on token blocks (INTO), flat token streams and significant token views for c-src-parser.}
+]
+
+do %test-fn-parse.r
+
+timeit: funct [block][recycle start: now/precise do block difference now/precise start]
+
+; The C file to tokenise is given on the command line, for example
+; src/core/n-system.c of a Ren-C checkout.
+if empty? any [system/options/args []] [
+	do make error! {Usage: bench-token-matching.r <C source file>}
+]
+text: read to-rebol-file first system/options/args
+
+c-src-flat-parser: context [
+
+	white-space: token-matching/flat c-src-parser/whitespace-tokens copy [eol | nl | wsp | span-comment | line-comment]
+
+	grammar: token-grammar/bare/flat c-src/grammar c-src-parser/tokens [any white-space] c-src-parser/bare-terms
+]
+
+tokens: tokenise get in c-pp-tokeniser 'token text
+flat: flat-tokens tokens
+view: significant-tokens tokens c-src-parser/whitespace-tokens
+
+results: reduce [
+	'into timeit [parse tokens c-src-parser/grammar/rule]
+	'flat timeit [parse flat c-src-flat-parser/grammar/rule]
+	'significant timeit [parse view/1 c-src-significant-parser/grammar/rule]
+]
+
+valid: reduce [
+	'into parse tokens c-src-parser/grammar/rule
+	'flat parse flat c-src-flat-parser/grammar/rule
+	'significant parse view/1 c-src-significant-parser/grammar/rule
+]
+
+?? valid
+print mold new-line/all/skip results true 2
@@ -0,0 +1,19 @@
+REBOL [
+	Title: "C Parse Worker"
+	Purpose: {Worker process for parallel-parse. Argument is the job file.}
+]
+
+change-dir first split-path system/options/script
+
+job: to-rebol-file first system/options/args
+
+; Always leave a result, so the driver does not wait for a worker that failed.
+if error? set/any 'failure try [
+	do %c-parallel-parse.reb
+	parse-job job
+] [
+	temp: join job %.tmp
+	write temp mold compose [error (form get/any 'failure)]
+	rename temp second split-path join job %.out
+]
+quit
@@ -2,6 +2,7 @@ REBOL []
 
 do %c-pp-tokeniser.reb
 do %token-kit.reb
+do %c-functions.reb
 
 c-src: context [
 
@@ -59,11 +60,6 @@ c-src-parser: context [
 		other-pp-token
 	]
 
-	grammar: make c-src/grammar []
-	terms: words-of grammar
-
-	; Rewrite terms to recognise token blocks.
-
 	white-space: [eol | nl | wsp | span-comment | line-comment]
 	not-eol: parsing-unless [eol]
 
@@ -71,21 +67,30 @@ c-src-parser: context [
 	tokens: union grammar-tokens whitespace-tokens
 	any-eols: token-matching whitespace-tokens [any eol]
 
-	use [rule][
-		token-matching whitespace-tokens white-space
-		token-matching whitespace-tokens not-eol
-		foreach term terms [
-			rule: copy/deep compose [(get term)]
-;;			token-matching/pre/post tokens rule [any white-space] [any [not-eol white-space] any-eols]
-;;			token-matching/post tokens rule [any white-space]
-			either parse/all form term [[thru {not-} | thru {is-}] to end] [
-				token-matching tokens rule
-			][
-				token-matching/pre tokens rule [any white-space]
-			]
-			grammar/:term: rule
+	token-matching whitespace-tokens white-space
+	token-matching whitespace-tokens not-eol
+
+	; Rewrite terms to recognise token blocks.
+	; Guard terms (not-, is-) do not skip white-space.
+
+	bare-terms: collect [
+		foreach term words-of c-src/grammar [
+			if parse/all form term [[thru {not-} | thru {is-}] to end] [keep term]
 		]
 	]
+
+;;	token-matching/pre/post tokens rule [any white-space] [any [not-eol white-space] any-eols]
+;;	token-matching/post tokens rule [any white-space]
+	grammar: token-grammar/bare/cache c-src/grammar tokens [any white-space] bare-terms %c-src-parser.cache
+	terms: words-of grammar
+]
+
+; Match significant-tokens views, white-space is not in the token stream.
+
+c-src-significant-parser: context [
+
+	grammar: token-grammar/cache c-src/grammar c-src-parser/grammar-tokens [] %c-src-significant-parser.cache
+	terms: words-of grammar
 ]
 
 comment {
@@ -100,6 +105,16 @@ terms: words-of c-src-parser/grammar
 remove-each x terms [parse/all form x [[thru {not-} | thru {is-}] to end]]
 delta-time [t: get-parse/terminal [parse r/1 c-src-parser/grammar/rule] terms bind [function.id] c-src-parser/grammar]
 
+v: significant-tokens r/1 c-src-parser/whitespace-tokens
+delta-time [t: get-parse/terminal [parse v/1 c-src-significant-parser/grammar/rule] terms bind [function.id] c-src-significant-parser/grammar]
+
+; Jump over braced bodies with a bracket index instead of stepping through them.
+closes: bracket-index r/1
+c-src-parser/grammar/braced: compose [any c-src-parser/white-space (c-src-parser/grammar/is-lbrace) (bracketed closes)]
+
+; Function boundaries in one pass, without get-parse.
+delta-time [fns: c-functions r/1]
+
 visualise-parse r/1 c-src-parser/grammar [t: get-parse/terminal [parse r/1 c-src-parser/grammar/rule] terms bind [function.id] c-src-parser/grammar]
 
 